@@ -0,0 +1,230 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "exec.h"
+
+// Vectorized execution (VECTOR option).  Instead of a tuple per call,
+// the operators here hand each other a batch of up to BATCHSIZE tuples
+// at a time, stored by column: the values of one attribute for all the
+// tuples of the batch lie next to each other in a typed vector (int,
+// float, or char(attrLen) values attrLen bytes apart).  An operator
+// then does its work in a loop over a column, with no call per tuple.
+//
+// Which tuples of a batch are still in the result is given by its
+// selection vector, the positions of those tuples in increasing order.
+// A filter only shortens the selection vector, and a projection only
+// picks columns, so neither copies any values.
+//
+// Values stay as they are stored (dictionary codes included) until
+// BatchToTuples turns batches back into tuples for the operators,
+// printing and result relations that take tuples.
+
+extern bool Vectorized;                 // run queries a batch at a time
+
+const int BATCHSIZE = 1024;             // most tuples in a batch
+
+class Batch {
+ public:
+  Batch();
+  ~Batch();
+
+  // gives the batch columns of its own for the attributes of schema
+  void allocate(const vector<AttrDesc> & schema);
+
+  int *ints(const int c) const { return (int *)cols[c]; }
+  float *floats(const int c) const { return (float *)cols[c]; }
+  char *chars(const int c) const { return cols[c]; }
+
+  int count;                            // tuples in the batch
+  int *sel;                             // positions of those selected
+  int selCnt;                           // and their number
+  vector<char *> cols;                  // column c: values of attribute c
+
+ private:
+  bool owner;                           // cols and sel are ours
+};
+
+
+// Batch at a time iterator; like an Iterator, except that next()
+// returns a batch (owned by the iterator, and valid until the
+// following call) with at least one tuple selected, or FILEEOF.
+// The schema gives the attribute of each column; the attribute
+// offsets are those in the tuples the column was read from.
+
+class BatchIter {
+ public:
+  virtual ~BatchIter() {}
+
+  virtual Status open() = 0;
+  virtual Status next(Batch *& batch) = 0;
+  virtual Status close() = 0;
+
+  const int attrCnt() const { return schema.size(); }
+  const AttrDesc *attrs() const { return &schema[0]; }
+
+  // column of attribute attrName of relation relName, or -1
+  const int find(const char *relName, const char *attrName) const;
+
+ protected:
+  vector<AttrDesc> schema;
+};
+
+
+// Scan of relation relName that reads the attributes attrs (from the
+// catalog) into columns, a page at a time.  If a filter is given, the
+// file's zone map is used to skip pages where `attr op filter' cannot
+// hold; the tuples of the other pages are all returned, for a
+// BatchFilter to test.
+
+class BatchScan : public BatchIter {
+ public:
+  BatchScan(const string & relName, const int attrCnt,
+	    const AttrDesc attrs[], const AttrDesc *attr,
+	    const Operator op, const char *filter);
+  ~BatchScan();
+
+  Status open();
+  Status next(Batch *& batch);
+  Status close();
+
+ private:
+  string relName;
+  HeapFileScan *scan;
+  bool hasFilter;
+  AttrDesc filterAttr;
+  Operator op;
+  char filter[MAXSTRINGLEN];
+  Page *page;                           // page being read, NULL if none
+  RID rid;                              // its next record
+  Batch out;
+  const char **recs;                    // the records of out
+
+  void gather(const int from, const int to);  // fill out[from, to)
+};
+
+
+// The tuples of child for which `column op value' holds; value is a
+// stored value of the column's attribute.
+
+class BatchFilter : public BatchIter {
+ public:
+  BatchFilter(BatchIter *child, const int column, const Operator op,
+	      const char *value);
+  ~BatchFilter();
+
+  Status open();
+  Status next(Batch *& batch);
+  Status close();
+
+ private:
+  BatchIter *child;
+  int column;
+  Operator op;
+  char value[MAXSTRINGLEN];
+};
+
+
+// the columns columns[0..projCnt-1] of child, in that order
+
+class BatchProject : public BatchIter {
+ public:
+  BatchProject(BatchIter *child, const int projCnt, const int columns[]);
+  ~BatchProject();
+
+  Status open();
+  Status next(Batch *& batch);
+  Status close();
+
+ private:
+  BatchIter *child;
+  vector<int> columns;
+  Batch out;                            // child's columns, rearranged
+};
+
+
+// Equi-join of the batches of probe with the tuples of build, on
+// column probeColumn of probe and attribute buildAttr of build.  The
+// build tuples (about buildRecCnt of them) are all read into a
+// JoinHashTable when the join is opened, so they have to fit in
+// memory.  The result has the columns of probe and the attributes
+// buildAttrs[] of the build tuples, those of the outer input first.
+
+class BatchHashJoin : public BatchIter {
+ public:
+  BatchHashJoin(BatchIter *probe, Iterator *build, const int probeColumn,
+		const AttrDesc & buildAttr, const int buildRecCnt,
+		const int buildAttrCnt, const AttrDesc buildAttrs[],
+		const bool buildIsOuter);
+  ~BatchHashJoin();
+
+  Status open();
+  Status next(Batch *& batch);
+  Status close();
+
+ private:
+  BatchIter *probe;
+  Iterator *build;
+  int probeColumn;
+  AttrDesc buildAttr;
+  vector<AttrDesc> buildAttrs;
+  int probeOffset, buildOffset;         // first column of each in out
+  JoinHashTable *table;
+  Batch *in;                            // probe batch being joined
+  int inPos;                            // position in its selection
+  const char *match;                    // next match of that tuple
+  const char **heads;                   // first match of each tuple
+  Batch out;
+  int *probePos;                        // tuple of in, and build tuple,
+  const char **buildRecs;               // of each tuple of out
+  int tupleCnt;
+  int buildRecCnt;
+
+  void gather(const int from, const int to);  // fill out[from, to)
+};
+
+
+// Aggregate functions over a column, without grouping.  The result is
+// one tuple with a column per aggregate: an INTEGER for CountAgg, a
+// FLOAT for AvgAgg, and a value of the column's type for the others.
+
+class BatchAgg : public BatchIter {
+ public:
+  BatchAgg(BatchIter *child, const int aggCnt, const AggFunc funcs[],
+	   const int columns[]);
+  ~BatchAgg();
+
+  Status open();
+  Status next(Batch *& batch);
+  Status close();
+
+ private:
+  BatchIter *child;
+  vector<AggFunc> funcs;
+  vector<int> columns;
+  bool done;
+  Batch out;
+};
+
+
+// Turns the batches of child into packed tuples of the attributes
+// outAttrs, decoding encoded attributes, the way ProjectIter does for
+// tuples.  If outAttrs is NULL the attributes are named after the
+// columns.
+
+class BatchToTuples : public Iterator {
+ public:
+  BatchToTuples(BatchIter *child, const attrInfo outAttrs[]);
+  ~BatchToTuples();
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+
+ private:
+  BatchIter *child;
+  vector<AttrDesc> srcAttrs;            // a column value, at offset 0
+  char *data;                           // the tuples of a batch
+  int tupleCnt, pos;
+};
+
+#endif
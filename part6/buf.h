@@ -128,6 +128,10 @@ public:
   const Status disposePage(File* file, const int PageNo); // dispose of page in file
   void  printSelf();
 
+  // number of frames not pinned by anyone (what an operator such
+  // as a sort may use)
+  const int numUnpinned() const;
+
   const BufStats & getBufStats() const // get buffer pool usage
   {
 	return bufStats;
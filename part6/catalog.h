@@ -17,23 +17,65 @@
 // schema of relation catalog:
 //   relation name : char(32)           <-- lookup key
 //   attribute count : integer(4)
+//   record length : integer(4)
 
 
 typedef struct {
   char relName[MAXNAME];                // relation name
   int attrCnt;                          // number of attributes
+  int recLen;                           // length of a tuple in bytes
 } RelDesc;
 
 
+// How createRel places attributes within a tuple.  PACKED stores
+// the attributes back to back in schema order.  ALIGNED stores the
+// numeric attributes first so that each one sits at a naturally
+// aligned offset, followed by the strings, and pads the tuple to a
+// multiple of the word size so that tuples stay aligned on a page.
+// Either way the catalog keeps the attributes in schema order; only
+// their offsets differ.
+
+enum LayoutPolicy { PACKED, ALIGNED };
+
+extern LayoutPolicy RecordLayout;       // layout used for new relations
+
+
 typedef struct {
   char relName[MAXNAME];                // relation name
   char attrName[MAXNAME];               // attribute name
   int  attrType;                        // INTEGER, FLOAT, or STRING
   int  attrLen;                         // length of attribute in bytes
+  int  attrEncoded;                     // dictionary encode (STRING only)
   void *attrValue;                      // ptr to binary value
 } attrInfo; 
 
 
+// schema of attribute catalog:
+//   relation name : char(32)           <-- lookup keys
+//   attribute name : char(32)          <--
+//   attribute number : integer(4)
+//   attribute type : integer(4)  (type is Datatype actually)
+//   attribute size : integer(4)
+//   encoded size : integer(4)
+
+
+typedef struct {
+  char relName[MAXNAME];                // relation name
+  char attrName[MAXNAME];               // attribute name
+  int attrOffset;                       // attribute offset
+  int attrType;                         // attribute type
+  int attrLen;                          // attribute length
+  int attrEncLen;                       // length of encoded STRING, or 0
+} AttrDesc;
+
+
+// A dictionary-encoded STRING attribute of length n is stored as an
+// INTEGER code: attrType is INTEGER, attrLen is sizeof(int), and
+// attrEncLen is n.  Anything that only compares or moves stored values
+// (scans, sorting, hashing) works on the codes unchanged; see dict.h
+// for the places where the string values are needed.
+
+
 class RelCatalog : public HeapFile {
  public:
   // open relation catalog
@@ -42,6 +84,12 @@ class RelCatalog : public HeapFile {
   // get relation descriptor for a relation
   const Status getInfo(const string & relation, RelDesc& record);
 
+  // get tuple length and all attributes of a relation
+  const Status getLayout(const string & relation,
+			 int & recLen,
+			 int & attrCnt,
+			 AttrDesc *& attrs);
+
   // add information to catalog
   const Status addInfo(RelDesc & record);
 
@@ -64,23 +112,6 @@ class RelCatalog : public HeapFile {
 };
 
 
-// schema of attribute catalog:
-//   relation name : char(32)           <-- lookup keys
-//   attribute name : char(32)          <--
-//   attribute number : integer(4)
-//   attribute type : integer(4)  (type is Datatype actually)
-//   attribute size : integer(4)
-
-
-typedef struct {
-  char relName[MAXNAME];                // relation name
-  char attrName[MAXNAME];               // attribute name
-  int attrOffset;                       // attribute offset
-  int attrType;                         // attribute type
-  int attrLen;                          // attribute length
-} AttrDesc;
-
-
 class AttrCatalog : public HeapFile {
  friend class RelCatalog;
 
@@ -117,5 +148,6 @@ extern AttrCatalog *attrCat;
 extern Error error;
 extern Status createHeapFile(const string filename);
 extern Status destroyHeapFile(const string filename);
+extern Status truncateHeapFile(const string filename);
 
 #endif
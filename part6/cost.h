@@ -0,0 +1,73 @@
+#ifndef COST_H
+#define COST_H
+
+#include "query.h"
+
+// The cost model of the joins, which picks the join method of a query
+// unless one is forced with the NL, SM or HJ option.  Costs are in
+// page reads and writes, plus the work done per tuple, counted as a
+// fraction of a page I/O:
+//
+//   nested loops   the outer input once, and the inner input once per
+//                  block of outer tuples that fits in memory (unless
+//                  the inner input fits too, and stays buffered); each
+//                  inner tuple is compared with all of a block
+//   sort merge     both inputs sorted (a run written and read back,
+//                  more passes if the runs do not fit), then merged;
+//                  other operators than EQ are the sort-based
+//                  inequality join, which costs the same
+//   hash           both inputs read; if the smaller one does not fit
+//                  in memory, all but its resident part is written to
+//                  partitions and read back, and so is the matching
+//                  part of the other one
+//
+// Every method also pays for the tuples of its result, estimated from
+// the join selectivity of the statistics.  The frames are the buffer
+// frames not pinned when the join is planned, less the few the
+// iterators keep for themselves.
+
+const double CPUTUPLE = 0.02;           // handling a tuple
+const double CPUCOMPARE = 0.0005;       // comparing two join values
+const double SETUPCOST = 1;             // files or tables an operator
+					// makes before its first tuple
+
+// what the cost model knows of a join input
+struct JoinInput {
+  double tuples;                        // estimated tuples
+  double pages;                         // and pages they take up
+  int recLen;                           // length of a tuple
+};
+
+// the cost of a join by one method
+struct JoinCost {
+  JoinType method;
+  bool swap;                            // nested loops: the second
+					// input is the better outer one
+  double cost;
+};
+
+// cost of joining in1 and in2 by method, with frames free frames and
+// an estimated result of resultTuples tuples
+JoinCost joinCost(const JoinType method, const JoinInput & in1,
+		  const JoinInput & in2, const double resultTuples,
+		  const int frames);
+
+// the cheapest of the methods that can join on these attributes
+// (only nested loops, if their stored values cannot be compared
+// directly), and the cost of each in costs[NLJoin..HashJoin], -1 for
+// those that cannot
+JoinCost cheapestJoin(const JoinInput & in1, const JoinInput & in2,
+		      const Operator op, const bool directCompare,
+		      const double resultTuples, const int frames,
+		      double costs[]);
+
+// a join input for a relation, from its statistics or its file
+const Status relationInput(const string & relation, JoinInput & in);
+
+// pages taken up by tuples tuples of length recLen
+double tuplePages(const double tuples, const int recLen);
+
+// the name of a join method
+const char *joinName(const JoinType method);
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef DICT_H
+#define DICT_H
+
+#include <vector>
+#include <map>
+#include "catalog.h"
+
+
+// define if debug output wanted
+//#define DEBUGDICT
+
+
+// An order-preserving dictionary for a dictionary-encoded STRING
+// attribute.  The distinct values of the attribute are kept in sorted
+// order and codes are assigned in that order, so comparing two codes
+// gives the same answer as comparing (with strncmp) the strings they
+// stand for.  Equality and range predicates,
+// sorting and hashing can therefore work on the codes; values are
+// decoded only when they are printed or projected into an attribute
+// that is not encoded.
+//
+// The values are kept in a heap file named relName.attrName.dict with
+// one record (the code, then the char(attrEncLen) value) per value,
+// in code order, and are cached in memory the first time the
+// dictionary is used.  Codes are left with gaps between them, so a
+// new value usually gets a code between those of its neighbours and
+// only the dictionary file is rewritten.  When a gap runs out, all
+// the codes are numbered again and the relation is recoded in place;
+// load adds all the values of a file at once to do this at most once
+// per load.
+
+class Dictionary {
+ public:
+  // get the (cached) dictionary of an encoded attribute
+  static const Status get(const AttrDesc & attr, Dictionary *& dict);
+
+  // create an empty dictionary for an encoded attribute
+  static const Status create(const string & relation,
+			     const string & attrName);
+
+  // destroy the dictionaries of the encoded attributes of a relation
+  static const Status destroy(const int attrCnt, const AttrDesc attrs[]);
+
+  // copy the value of attribute src of srcRec into attribute dst of
+  // dstRec, decoding and/or encoding it as needed
+  static const Status copyAttr(const AttrDesc & src, const char *srcRec,
+			       const AttrDesc & dst, char *dstRec);
+
+  // number of distinct values
+  const int size() const { return values.size(); }
+
+  // returns the char(attrEncLen) value of a code
+  const char *decode(const int code) const;
+
+  // true if code stands for a value
+  const bool has(const int code) const;
+
+  // returns the code of a value, or RECNOTFOUND if it is not in the
+  // dictionary
+  const Status lookup(const char *value, int & code) const;
+
+  // returns the code of a value, adding the value to the dictionary
+  // (and recoding the relation) if necessary
+  const Status encode(const char *value, int & code);
+
+  // adds a batch of values (duplicates allowed) to the dictionary
+  const Status add(const vector<string> & newValues);
+
+  // rewrites the predicate `attr op value' as the equivalent predicate
+  // `code codeOp codeValue' on the codes
+  void translate(const char *value, const Operator op,
+		 int & codeValue, Operator & codeOp) const;
+
+ private:
+  Dictionary(const AttrDesc & attr);
+
+  const Status read();                  // read values from the file
+  const Status write();                 // rewrite the file
+  const Status recode(const vector<int> & newCodes);
+  const int lowerBound(const char *value) const;
+  string pad(const char *value) const;  // value as a char(attrEncLen)
+
+  AttrDesc attr;                        // the encoded attribute
+  string fileName;                      // name of dictionary file
+  vector<string> values;                // sorted values
+  vector<int> codes;                    // their codes, ascending
+
+  static map<string, Dictionary *> cache;
+};
+
+#endif
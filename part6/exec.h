@@ -0,0 +1,467 @@
+#ifndef EXEC_H
+#define EXEC_H
+
+#include "catalog.h"
+#include "query.h"
+#include "sort.h"
+#include "joinHT.h"
+#include "partition.h"
+#include "dict.h"
+
+// Query plans.  A query is run as a tree of iterators, each of which
+// hands out its result one tuple at a time (the Volcano model): open()
+// gets an iterator ready, every next() returns its next tuple, or
+// FILEEOF after the last one, and close() releases what it holds.  An
+// iterator pulls the tuples of its inputs as it needs them, so tuples
+// flow from the scans at the leaves to the root without being stored
+// in between, unless an operator has to have all of an input at once
+// (to sort it, partition it, or read it more than once).  Such an
+// input is read from a heap file: its relation if it is a plain scan,
+// or else a temporary file it is first materialized into.
+//
+// The tuples of an iterator have the layout its schema describes: one
+// AttrDesc per attribute, in order, giving its offset in the tuple.
+// An attribute keeps the relation and attribute name it was read from,
+// so that dictionary codes can still be decoded above the scan.  A
+// tuple returned by next() stays valid until the following call.
+//
+// An iterator owns (and deletes) its inputs.
+
+class Iterator {
+ public:
+  virtual ~Iterator() {}
+
+  virtual Status open() = 0;
+  virtual Status next(Record & rec) = 0;
+  virtual Status close() = 0;
+
+  // name of a heap file holding exactly the tuples of this iterator,
+  // in its layout, or "" if there is none (before open() for a
+  // materialized input)
+  virtual string fileName() const { return ""; }
+
+  // true if the tuples come in order of the attribute at position pos
+  // of the schema, so that equal values of it are next to each other
+  virtual bool sortedOn(const int pos) const { return false; }
+
+  const int attrCnt() const { return schema.size(); }
+  const AttrDesc *attrs() const { return &schema[0]; }
+  const int recLen() const { return length; }
+
+  // position of attribute attrName of relation relName in the schema,
+  // or -1 if it is not there
+  const int find(const char *relName, const char *attrName) const;
+
+ protected:
+  // makes the schema that of outer's tuples followed by inner's
+  void concat(const Iterator & outer, const Iterator & inner);
+
+  vector<AttrDesc> schema;
+  int length;                           // length of a tuple
+};
+
+
+// a scan of a heap file, filtered on one attribute if filter is given
+// (the file's zone maps then let the scan skip pages)
+
+class ScanIter : public Iterator {
+ public:
+  ScanIter(const string & relName, Status & status);
+  ScanIter(const string & relName, const AttrDesc *attr,
+	   const Operator op, const char *filter, Status & status);
+  // a scan of a file that is not in the catalog, with the given schema
+  ScanIter(const string & fileName, const Iterator & like);
+  ~ScanIter();
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+  string fileName() const { return hasFilter ? "" : relName; }
+
+ private:
+  Status init(const string & relName);
+
+  string relName;
+  HeapFileScan *scan;
+  bool hasFilter;
+  AttrDesc filterAttr;
+  Operator op;
+  char filter[MAXSTRINGLEN];            // the filter's value, stored
+};
+
+
+// the tuples of child for which `attr op value' holds; value is a
+// stored value of attr.  Or, for the residual predicates of a join,
+// those for which `attr op attr2' holds, attr2 being another attribute
+// of the tuple whose stored values compare directly with attr's.
+
+class FilterIter : public Iterator {
+ public:
+  FilterIter(Iterator *child, const AttrDesc & attr, const Operator op,
+	     const char *value);
+  FilterIter(Iterator *child, const AttrDesc & attr, const Operator op,
+	     const AttrDesc & attr2);
+  ~FilterIter();
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+  bool sortedOn(const int pos) const { return child->sortedOn(pos); }
+
+ private:
+  Iterator *child;
+  AttrDesc attr;
+  AttrDesc valueAttr;                   // attr, at offset 0 of value,
+					// or attr2
+  bool inTuple;                         // compared with attr2
+  Operator op;
+  char value[MAXSTRINGLEN];
+};
+
+
+// Projects the tuples of child on the attributes srcAttrs (a schema
+// entry of child each) into packed tuples of the attributes outAttrs,
+// which name the result's attributes and give their types.  Encoded
+// attributes are decoded, as in a result relation.
+
+class ProjectIter : public Iterator {
+ public:
+  ProjectIter(Iterator *child, const int projCnt, const AttrDesc srcAttrs[],
+	      const attrInfo outAttrs[]);
+  ~ProjectIter();
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+  bool sortedOn(const int pos) const;
+
+ private:
+  Iterator *child;
+  vector<AttrDesc> srcAttrs;
+  char *data;                           // the current output tuple
+};
+
+
+// Stores all the tuples of child in a temporary heap file when it is
+// opened, and then scans the file.  Closing it destroys the file.
+
+class MaterializeIter : public Iterator {
+ public:
+  MaterializeIter(Iterator *child);
+  ~MaterializeIter();
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+  string fileName() const { return isOpen ? name : ""; }
+  bool sortedOn(const int pos) const { return child->sortedOn(pos); }
+
+ private:
+  Iterator *child;
+  string name;                          // the temporary file
+  ScanIter *scan;
+  bool isOpen;
+};
+
+
+// The tuples of child in order of attribute attr (a schema entry of
+// child), sorted with a SortedFile.  If keep is given, only the tuples
+// it returns true for are sorted.  The sort uses as many buffer frames
+// as setFrames() gives it, or all the unpinned ones less a few.
+
+class SortIter : public Iterator {
+ public:
+  SortIter(Iterator *child, const AttrDesc & attr,
+	   const bool (*keep)(const Record & rec) = NULL);
+  ~SortIter();
+
+  // finds (materializing child if need be) the file that is sorted,
+  // and returns its number of tuples
+  Status input(int & recCnt);
+  void setFrames(const int frames) { this->frames = frames; }
+  void setKeep(const bool (*keep)(const Record & rec)) { this->keep = keep; }
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+
+  bool sortedOn(const int pos) const
+  { return schema[pos].attrOffset == attr.attrOffset; }
+
+  Status setMark() { return sorted->setMark(); }
+  Status gotoMark() { return sorted->gotoMark(); }
+
+ private:
+  Iterator *child;
+  AttrDesc attr;
+  const bool (*keep)(const Record & rec);
+  string file;                          // what is sorted
+  int frames;
+  SortedFile *sorted;
+};
+
+
+// The joins, in join.C.  A join of outer and inner on `outerAttr op
+// innerAttr' returns the concatenation of the outer and inner tuple of
+// each match, outer first.
+
+// block nested loops: the outer input is read a block at a time, and
+// the inner one (from its file) once per block
+class NLJoinIter : public Iterator {
+ public:
+  NLJoinIter(Iterator *outer, Iterator *inner, const AttrDesc & outerAttr,
+	     const Operator op, const AttrDesc & innerAttr);
+  ~NLJoinIter();
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+
+ private:
+  Status nextBlock();                   // read a block, start inner scan
+
+  Iterator *outer, *inner;
+  AttrDesc outerAttr, innerAttr;
+  Operator op;
+  Datatype keyType;                     // of the values compared
+  int keyLen;
+  Dictionary *dict1, *dict2;            // to decode the join values
+  HeapFileScan *innerScan;
+  int blockMax, n;                      // records a block holds, has
+  char *block;                          // outer records of the block
+  char *keys;                           // and their join values
+  int *match;                           // block records that match
+  int matchCnt, matchPos;               // the current inner record
+  Record innerRec;
+  bool outerDone;
+  char *data;                           // the current output tuple
+  int tupleCnt, blockCnt, pagesSkipped;
+  BufStats before;
+};
+
+// equi-join by merging the inputs sorted on the join attribute
+class SMJoinIter : public Iterator {
+ public:
+  SMJoinIter(Iterator *outer, Iterator *inner, const AttrDesc & outerAttr,
+	     const AttrDesc & innerAttr);
+  ~SMJoinIter();
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+  bool sortedOn(const int pos) const;
+
+ private:
+  SortIter *sorted1, *sorted2;
+  AttrDesc outerAttr, innerAttr;
+  BloomFilter *filter;
+  Record rec1, rec2;
+  Status status1, status2;
+  bool inGroup;                         // rec1 is being joined with the
+					// group of inner records in groupData
+  char *groupData;
+  char *data;
+  int tupleCnt;
+};
+
+// inequality join of the sorted inputs
+class IneqJoinIter : public Iterator {
+ public:
+  IneqJoinIter(Iterator *outer, Iterator *inner, const AttrDesc & outerAttr,
+	       const Operator op, const AttrDesc & innerAttr);
+  ~IneqJoinIter();
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+
+ private:
+  SortIter *sorted1, *sorted2;
+  SortIter *driver, *prefix;
+  AttrDesc outerAttr, innerAttr;
+  AttrDesc driverAttr, prefixAttr;
+  Operator op;
+  bool outerDrives;
+  int limit;
+  int driverLen, prefixLen;
+  int blockMax, n;
+  char *block;                          // driving records of the block
+  char *pData;                          // the current prefix record
+  int lo, eq, pos;                      // its matches in the block
+  bool blockOpen, havePrefix, driverDone;
+  char *data;
+  int tupleCnt;
+};
+
+// hybrid hash join, building on the smaller input
+class HashJoinIter : public Iterator {
+ public:
+  HashJoinIter(Iterator *outer, Iterator *inner, const AttrDesc & outerAttr,
+	       const AttrDesc & innerAttr);
+  ~HashJoinIter();
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+
+ private:
+  // a join of partition files at a deeper level
+  HashJoinIter(const HashJoinIter & parent, const string & buildName,
+	       const string & probeName, const string & name);
+
+  Status start();                       // build, partition if need be
+  Status nextPart();                    // move on to the next partition
+
+  Iterator *outer, *inner;
+  AttrDesc outerAttr, innerAttr;
+  int outerLen, innerLen;
+  int level;                            // depth of partitioning
+  string baseName;                      // of this level's partitions
+  bool buildIsOuter;
+  AttrDesc buildAttr, probeAttr;
+  string buildName, probeName;
+  int buildLen;
+  BloomFilter *filter;                  // level 0 only
+  JoinHashTable *table;
+  HeapFileScan *probeScan;
+  Record probeRec;
+  vector<const char *> matches;
+  int matchPos;
+  Partition *buildPartition, *probePartition;
+  string *buildParts, *probeParts;
+  int P, part;                          // partition being joined
+  HashJoinIter *sub;                    // and its join
+  char *data;
+  int tupleCnt;
+};
+
+
+// The aggregations, in agg.C.  An aggregation groups the tuples of
+// child on the attributes at positions groups[] of child's schema and
+// returns a tuple per group: the group attributes, followed by the
+// aggregates funcs[] of the attributes at positions aggAttrs[] (-1 for
+// count(*)).  Without group attributes all of child is one group, and
+// there is a result tuple even if child has none.  An aggregate is an
+// INTEGER for count, a FLOAT for avg, and of its attribute's type for
+// the others; sum and avg take INTEGER and FLOAT attributes only.
+
+class AggIter : public Iterator {
+ public:
+  ~AggIter();
+
+  // hash of the group of tuple rec of child; each seed gives a
+  // different function
+  unsigned hash(const char *rec, const unsigned seed) const;
+
+ protected:
+  AggIter(Iterator *child, const int groupCnt, const int groups[],
+	  const int aggCnt, const AggFunc funcs[], const int aggAttrs[]);
+  // the same aggregation of another input with child's layout
+  AggIter(const AggIter & other, Iterator *child);
+
+  // The state of a group: its number of tuples, the values of its
+  // group attributes laid out as in the result, and a slot per
+  // aggregate holding a sum or the least or greatest value.
+  void start(char *state, const char *rec) const;  // group of rec
+  void add(char *state, const char *rec) const;
+  bool inGroup(const char *state, const char *rec) const;
+  void result(const char *state, Record & rec);
+
+  Iterator *child;
+  vector<AttrDesc> groupAttrs;          // of child
+  vector<AggFunc> funcs;
+  vector<AttrDesc> aggAttrs;            // of child, attrLen 0 for count(*)
+  vector<AttrDesc> slotAttrs;           // the aggregates' state slots
+  int keyLen;                           // of the group attributes
+  int stateLen;
+  char *data;                           // the current output tuple
+  int tupleCnt;
+};
+
+// hash aggregation: a hash table of group states, as many as fit in
+// the unpinned buffer frames; tuples of groups that do not fit are
+// spilled to partitions, which are aggregated the same way afterwards
+class HashAggIter : public AggIter {
+ public:
+  HashAggIter(Iterator *child, const int groupCnt, const int groups[],
+	      const int aggCnt, const AggFunc funcs[], const int aggAttrs[]);
+  ~HashAggIter();
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+
+ private:
+  // the aggregation of a partition at a deeper level
+  HashAggIter(const HashAggIter & parent, const string & partName,
+	      const string & name);
+
+  Status build();                       // aggregate the input
+  Status spill(const Record & rec);     // a tuple of a group not kept
+  Status nextPart();                    // move on to the next partition
+  void grow();                          // double the table
+  void clear();                         // drop the groups
+
+  int level;                            // depth of partitioning
+  string baseName;                      // of this level's spill files
+  int maxGroups;                        // groups the table may hold
+  TupleArena *arena;                    // the group states
+  vector<char *> states;                // in the order they were made
+  vector<unsigned> hashes;              // of each state's group
+  vector<int> slots;                    // open addressed, into states
+  int pos;                              // next state returned
+  string overflowName;                  // tuples of the groups not kept
+  InsertFileScan *overflow;
+  int spillCnt;
+  Partition *partition;
+  string *partNames;
+  int P, part;                          // partition being aggregated
+  HashAggIter *sub;                     // and its aggregation
+};
+
+// aggregation of input whose tuples of a group are next to each
+// other (sorted on the group attribute): one group at a time
+class SortAggIter : public AggIter {
+ public:
+  SortAggIter(Iterator *child, const int groupCnt, const int groups[],
+	      const int aggCnt, const AggFunc funcs[], const int aggAttrs[]);
+  ~SortAggIter();
+
+  Status open();
+  Status next(Record & rec);
+  Status close();
+
+ private:
+  char *state;                          // of the group being read
+  bool inProgress, done;
+};
+
+
+// shared by the operators
+
+// number of records of length recLen that fit in the given number of
+// pages; used to turn a budget of buffer frames into records (which
+// is also how SortedFile sizes its runs)
+int pageRecords(const int pages, const int recLen);
+
+// compare the stored values of attributes a1 of rec1 and a2 of rec2,
+// which have the same type and length: < 0, 0 or > 0
+int attrCmp(const char *rec1, const AttrDesc & a1,
+	    const char *rec2, const AttrDesc & a2);
+
+// true if two join attributes are of the same type and length, as
+// declared (in join.C)
+bool sameValueType(const AttrDesc & a1, const AttrDesc & a2);
+
+// true if the stored values of two join attributes can be compared
+// directly (in join.C)
+bool sameStoredValues(const AttrDesc & a1, const AttrDesc & a2);
+
+// the operator op' for which `b op' a' holds when `a op b' does
+Operator reverseOp(const Operator op);
+
+// makes name the file input reads its tuples from, putting a
+// MaterializeIter (opened) over input if it has none
+Status inputFile(Iterator *& input, string & name);
+
+#endif
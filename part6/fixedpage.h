@@ -0,0 +1,72 @@
+#ifndef FIXEDPAGE_H
+#define FIXEDPAGE_H
+
+#include "page.h"
+
+const unsigned FPFIXED = 4*sizeof(short)+2*sizeof(int);
+const unsigned FPDATASIZE = PAGESIZE-FPFIXED;
+// size of the data area (bitmap + records) of a fixed-width page
+
+// Class definition for a minirel data page holding fixed-width
+// records.  Every record on the page has the same length, so there
+// is no slot array: record i lives at a computed offset in data[]
+// and a presence bitmap at the front of data[] says which slots are
+// in use.  Records are never moved, so deletes need no compaction.
+// The record area starts on a word boundary, so records whose
+// length is a multiple of the word size stay aligned.
+//
+// Like Page, a FixedPage is exactly PAGESIZE bytes and can be
+// overlaid on a buffer pool frame.
+
+class FixedPage {
+private:
+    char	data[FPDATASIZE]; // presence bitmap, then the records
+    short	recLen;   // length of every record on the page
+    short	slotCnt;  // number of record slots on the page
+    short	recCnt;   // number of slots in use
+    short	freeHint; // no slot below this one is free
+    int		nextPage; // forwards pointer
+    int		curPage;  // page number of current pointer
+
+    const bool slotInUse(const int slotNo) const
+    {
+	return (data[slotNo >> 3] >> (slotNo & 7)) & 1;
+    }
+    char* slotPtr(const int slotNo)
+    {
+	return &data[recStart() + slotNo * recLen];
+    }
+    const int recStart() const; // offset of slot 0 in data[]
+
+public:
+    // number of records of length recLen that fit on one page
+    static const int capacity(const int recLen);
+
+    void init(const int pageNo, const int recLen); // initialize a new page
+    void dumpPage() const;       // dump contents of a page
+
+    const Status getNextPage(int& pageNo) const; // returns value of nextPage
+    const Status setNextPage(const int pageNo); // sets value of nextPage to pageNo
+    const short getFreeSpace() const; // returns amount of free space
+    const int getRecCnt() const;      // returns number of records on page
+
+    // inserts a new record (rec) into the page, returns RID of record
+    // rec.length must equal the record length the page was built with
+    const Status insertRecord(const Record & rec, RID& rid);
+
+    // delete the record with the specified rid
+    const Status deleteRecord(const RID & rid);
+
+    // returns RID of first record on page
+    // returns  NORECORDS if page contains no records.  Otherwise, returns OK
+    const Status firstRecord(RID& firstRid) const;
+
+    // returns RID of next record on the page
+    // returns ENDOFPAGE if no more records exist on the page
+    const Status nextRecord (const RID & curRid, RID& nextRid) const;
+
+    // returns reference to record with RID rid
+    const Status getRecord(const RID & rid, Record & rec);
+};
+
+#endif
@@ -24,6 +24,51 @@ const unsigned MAXNAMESIZE = 50;
 enum Datatype { STRING, INTEGER, FLOAT };    // attribute data types
 enum Operator { LT, LTE, EQ, GTE, GT, NE };  // scan operators
 
+// Page directory.  Every heap file keeps a directory of its data
+// pages on a chain of directory pages rooted in the file header, one
+// entry per data page in the same order as the data page chain.  An
+// entry holds the page number, the free space and the number of
+// records on the page, so the pages of a file can be listed (and
+// scanned in any order) without reading them.
+//
+// Zone maps.  An entry may also hold the smallest and largest value,
+// on the page, of up to MAXZONEATTRS attributes of the file.  These
+// are widened when a record is inserted or updated in place and left
+// alone on delete, so they may be wider than the page's contents but
+// never narrower.  A filtered scan on a summarized attribute uses
+// them to skip (without reading) pages that cannot hold a match.
+// Values are summarized as 4-byte keys: INTEGER and FLOAT values are
+// used as is, STRING values by their first 4 bytes (zero padded after
+// the end of the string), which still orders them correctly.
+
+const int MAXZONEATTRS = 8;             // attributes summarized per page
+
+struct ZoneAttr
+{
+  int		offset;		// offset of attribute in record
+  int		length;		// length of attribute
+  Datatype	type;		// type of attribute
+};
+
+// entry for a data page: pageNo, free space, number of records,
+// then a min and max key for each summarized attribute
+const int DIRPAGEINTS = PAGESIZE / sizeof(int) - 2;
+
+struct DirPage
+{
+  int		nextPage;	// next directory page, -1 if none
+  int		entryCnt;	// number of entries on this page
+  int		entries[DIRPAGEINTS];
+};
+
+// what the directory says about a data page
+struct PageInfo
+{
+  int		pageNo;		// page number
+  int		freeSpace;	// free space on the page
+  int		recCnt;		// records on the page
+};
+
 struct FileHdrPage
 {
   char		fileName[MAXNAMESIZE];   // name of file
@@ -31,6 +76,20 @@ struct FileHdrPage
   int		lastPage;	// pageNo of last data page in file
   int		pageCnt;	// number of pages
   int		recCnt;		// record count
+  int		firstDirPage;	// first page of the page directory
+  int		lastDirPage;	// last page of the page directory
+  int		zoneAttrCnt;	// number of summarized attributes
+  ZoneAttr	zoneAttrs[MAXZONEATTRS];
+};
+
+
+// a change made to records in place: length bytes of value replace
+// the fixed-width attribute at offset
+struct FieldUpdate
+{
+  int		offset;		// offset of attribute in record
+  int		length;		// length of attribute
+  const char*	value;		// new value, as stored
 };
 
 
@@ -47,6 +106,23 @@ protected:
    bool  	curDirtyFlag;   // true if page has been updated
    RID   	curRec;         // rid of last record returned
 
+   DirPage*	dirPage;	// directory page pinned in buffer pool
+   int		dirPageNo;	// its page number, -1 if none
+   bool		dirDirty;	// true if directory page has been updated
+   int		dirIdx;		// index of current entry on dirPage
+
+   const Status dirRead(const int pageNo);        // pin a directory page
+   const Status dirRelease();                     // unpin it
+   const Status dirSeek(const int pageNo, bool & found);
+   const Status dirNext(bool & found);            // step to next entry
+   int* dirEntry() const;                         // current entry
+   const bool dirOn(const int pageNo) const;      // entry is pageNo's?
+   const Status dirAppend(const int pageNo, const int freeSpace);
+   // update curPage's entry after rec was inserted (recDelta 1),
+   // updated (0) or deleted (-1, rec NULL)
+   const Status dirUpdate(const Record* rec, const int recDelta);
+   const Status rebuildDir();                     // from the data pages
+
 public:
 
   // initialize
@@ -60,6 +136,18 @@ public:
 
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record & rec);
+
+  // (re)build the zone map of the file, summarizing the given
+  // attributes of every record
+  const Status buildZoneMap(const int attrCnt, const ZoneAttr attrs[]);
+
+  // list the data pages of the file, in chain order
+  const Status getPageList(vector<PageInfo> & pages);
+
+  // unlink and free the data pages that hold no records, as the
+  // directory counts them: all of them, or only those of pageNos
+  // (e.g. the pages deleteMatches() emptied)
+  const Status compact(const vector<int>* pageNos = NULL);
 };
 
 
@@ -88,12 +176,41 @@ public:
     // read current record, returning pointer and length
     const Status getRecord(Record & rec);
 
+    // move on to the next page that may hold a match and return it,
+    // pinned until the next call or the end of the scan.  The records
+    // of the page are not filtered; the predicate only lets the zone
+    // map skip pages.
+    const Status scanPage(Page* & page);
+
     // delete current record 
     const Status deleteRecord();
 
-    // marks current page of scan dirty
+    // delete every record satisfying the scan's predicate, a page at
+    // a time, returning how many went in deleted and the pages left
+    // without records in emptied.  The scan must have just been
+    // started, and is at its end afterwards.
+    const Status deleteMatches(int & deleted, vector<int> & emptied);
+
+    // change, in place, fields fieldCnt of every record satisfying
+    // the scan's predicate, a page at a time, returning how many were
+    // changed in updated.  Records keep their RIDs.  As for
+    // deleteMatches(), the scan must have just been started.
+    const Status updateMatches(const int fieldCnt,
+			       const FieldUpdate fields[],
+			       int & updated);
+
+    // marks current page of scan dirty (after updating the current
+    // record in place)
     const Status markDirty();
 
+    // number of pages the zone map let the scan skip
+    const int getPagesSkipped() const;
+
+    // restrict the scan to the given data pages, in the given order
+    // (e.g. a share of getPageList() for one of several scans), and
+    // restart it
+    const Status setPages(const vector<int> & pageNos);
+
 private:
     int   offset;            // byte offset of filter attribute
     int   length;            // length of filter attribute
@@ -107,8 +224,21 @@ private:
     // scan to be rolled back to the following
     int   markedPageNo;	// page number of pinned page
     RID   markedRec;         // rid of last record returned
+    int   markedPageIdx;     // position in scanPages
+
+    int   zoneAttr;          // summarized attribute of filter, or -1
+    int   zoneKey;           // filter as a zone map key
+    int   pagesSkipped;      // pages skipped thanks to the zone map
+    vector<int> scanPages;   // pages to scan, if restricted
+    int   scanPageIdx;       // position in scanPages
+    bool  restricted;        // true if setPages() was called
+    bool  pageScan;          // scanPage() has returned a page
 
     const bool matchRec(const Record & rec) const;
+    const bool zoneMatch(const int* entry) const;
+    const Status nextListedPage(int & pageNo);
+    const Status firstScanPage(int & pageNo);
+    const Status nextScanPage(int & pageNo);
 };
 
 
@@ -123,6 +253,10 @@ public:
 
     // insert record into file, returning its RID
     const Status insertRecord(const Record & rec, RID& outRid); 
+
+    // append page, a data page filled in memory, to the file as a
+    // whole; its page number and next page are ignored
+    const Status appendPage(const Page & page);
 };
 
 #endif
@@ -1,40 +1,129 @@
+#ifndef JOINHT_H
+#define JOINHT_H
 
-class joinHashTbl
+#include "catalog.h"
+
+// Arena that build tuples are copied into.  Memory is taken from
+// large chunks and only given back when the arena is destroyed, so
+// allocation is a pointer bump and the tuples of a build are packed
+// together.
+
+class TupleArena
 {
 private:
-    union JAttrType
-    {
-	int iValue;
-	float fValue;
-	char* sValue;
-    };
-	
-    struct joinhashBucket
-    {
-	union JAttrType	attrValue;
-       	RID	rid;
-       	joinhashBucket*     next;    // next node in the hash table
-    };
+    vector<char*> chunks;
+    int chunkSize;
+    int used;          // bytes used in the last chunk
+    long total;        // bytes in all chunks
+
+public:
+    TupleArena(const int chunkSize = 64 * 1024);
+    ~TupleArena();
+
+    // len bytes, aligned for a pointer
+    char* alloc(const int len);
 
-    struct HTentry
+    const long size() const { return total; }
+};
+
+
+// Hash table for the build side of a hash join.  The table is open
+// addressed with linear probing and holds one slot per distinct join
+// attribute value.  A slot keeps the hash and a 4 byte key inline (the
+// value itself for INTEGER and FLOAT, a prefix for STRING), so most
+// probes are settled without touching the tuples.  The build tuples
+// are copied into an arena, and all tuples with the same value are
+// chained off their slot.
+
+class JoinHashTable
+{
+private:
+    struct Slot
     {
-	int bucketCnt;  // nuumber of buckets on this chain
-	joinhashBucket*   chain;  // pointer to first bucket on the chain
+	unsigned hash;
+	int key;         // inline key, see inlineKey()
+	char* first;     // first tuple with this value, NULL if empty
     };
 
-    AttrDesc 	joinAttr;
-    int 	HTSIZE;
-    HTentry 	*ht; // actual hash table
-    int  hash(const char* attr, int attrType); // returns value between 0 and HTSIZE-1
+    AttrDesc attr;     // join attribute of the build tuples
+    int tupleLen;
+    unsigned seed;
+    Slot* slots;
+    unsigned mask;     // number of slots - 1
+    int keyCnt;        // slots in use
+    int tupleCnt;
+    TupleArena arena;
+
+    int inlineKey(const char* attrPtr) const;
+    bool sameKey(const Slot & slot, const unsigned h, const int key,
+		 const char* attrPtr) const;
+    void grow();
 
 public:
-    joinHashTbl(const int size, const AttrDesc attr);  // constructor
-    ~joinHashTbl();
+    // attr is the join attribute, tupleLen the length of a build tuple
+    // and expected the number of tuples that will be inserted
+    JoinHashTable(const AttrDesc & attr, const int tupleLen,
+		  const int expected, const unsigned seed = 0);
+    ~JoinHashTable();
+
+    // copy a build tuple into the table
+    Status insert(const char* tuple);
 
-     // insert a new (JoinAttrValue, RID) pair into hash table
-     Status insert(const RID newRid,  const char* tuple);
+    // put the build tuples whose join attribute equals the value at
+    // attrPtr in matches, replacing its contents; returns their number
+    int probe(const char* attrPtr, vector<const char*> & matches) const;
 
-     // get RIDs of records whose join attribute value matches innerJoinAttrValue
-     Status lookup(const char* innerJoinAttrPtr, int & ridCount, RID *&outRids);
+    // the same one at a time: the first matching build tuple, NULL if
+    // there is none, and the one after tuple (a match of the same
+    // value), NULL after the last
+    const char* first(const char* attrPtr) const;
+    static const char* next(const char* tuple);
+
+    const int size() const { return tupleCnt; }
+    const long memUsed() const;
+
+    // hash of the attribute value at p; equal values (in the sense of
+    // the join) hash alike, and each seed gives a different function
+    static unsigned hash(const char* p, const AttrDesc & attr,
+			 const unsigned seed);
+};
+
+
+// Blocked Bloom filter on the build keys of a join, used to drop
+// probe tuples that cannot match before they are partitioned, sorted
+// or probed.  Each key sets one bit in each word of a single
+// BLOOMWORDS word block, so a test reads one block.  The filter is
+// sized from the number of keys it will hold.
+
+const int BLOOMWORDS = 8;               // 32 bit words per block
+const int BLOOMBITSPERKEY = 10;         // before rounding up
+
+class BloomFilter
+{
+private:
+    AttrDesc attr;     // type and length of the keys
+    unsigned* blocks;
+    unsigned blockMask; // number of blocks - 1
+    int testCnt;       // keys tested
+    int rejectCnt;     // keys that failed the test
+
+    unsigned* block(const char* attrPtr, unsigned & h) const;
+
+public:
+    BloomFilter(const AttrDesc & attr, const int expected);
+    ~BloomFilter();
+
+    void add(const char* attrPtr);
+
+    // false if the value at attrPtr was certainly not added
+    bool mayContain(const char* attrPtr);
+
+    const int tested() const { return testCnt; }
+    const int rejected() const { return rejectCnt; }
+    const long size() const
+    {
+	return (long)(blockMask + 1) * BLOOMWORDS * sizeof(unsigned);
+    }
 };
 
+#endif
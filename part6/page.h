@@ -51,6 +51,8 @@ public:
 
     const Status getNextPage(int& pageNo) const; // returns value of nextPage
     const Status setNextPage(const int pageNo); // sets value of nextPage to pageNo
+    // sets the page number of a page image copied to another page
+    const Status setPageNo(const int pageNo);
     const short getFreeSpace() const; // returns amount of free space
 
     // inserts a new record (rec) into the page, returns RID of record 
@@ -59,6 +61,10 @@ public:
     // delete the record with the specified rid
     const Status deleteRecord(const RID & rid);
 
+    // delete the cnt records in slots slotNos (numbered as in a RID)
+    // at once, compacting the page a single time
+    const Status deleteRecords(const int slotNos[], const int cnt);
+
     // returns RID of first record on page
     // returns  NORECORDS if page contains no records.  Otherwise, returns OK
     const Status firstRecord(RID& firstRid) const;
@@ -11,6 +11,7 @@ typedef struct {
   char *attrName;                       // relation name
   int attrType;                         // type of attribute
   int attrLen;                          // length of attribute
+  int attrEncoded;                      // dictionary encoded?
 } ATTR_DESCR;
 
 
@@ -49,6 +50,7 @@ typedef enum {
     N_QUERY,
     N_INSERT,
     N_DELETE,
+    N_UPDATE,
     N_CREATE,
     N_DESTROY,
     N_BUILD,
@@ -56,9 +58,12 @@ typedef enum {
     N_DROP,
     N_LOAD,
     N_PRINT,
+    N_ANALYZE,
+    N_EXPLAIN,
     N_HELP,
     N_SELECT,
     N_JOIN,
+    N_AGGR,
     N_PRIMATTR,
     N_QUALATTR,
     N_ATTRVAL,
@@ -82,12 +87,15 @@ typedef struct node {
 	    char *relname;
 	    struct node *attrlist;
 	    struct node *qual;
+	    struct node *groupby;
 	} QUERY;
 
-	// insert node */
+	// insert node: rows is a list of value lists, one per tuple, for
+	// the <attribute, value> pairs of attrlist */
 	struct {
 	    char *relname;
 	    struct node *attrlist;
+	    struct node *rows;
 	} INSERT;
 
 	// delete node */
@@ -96,6 +104,13 @@ typedef struct node {
 	    struct node *qual;
 	} DELETE;
 
+	// update node: setlist is a list of <attribute, value> pairs */
+	struct {
+	    char *relname;
+	    struct node *setlist;
+	    struct node *qual;
+	} UPDATE;
+
 	// create node */
 	struct {
 	    char *relname;
@@ -132,6 +147,16 @@ typedef struct node {
 	    char *relname;
 	} PRINT;
 
+	// analyze node */
+	struct {
+	    char *relname;
+	} ANALYZE;
+
+	// explain node */
+	struct {
+	    struct node *query;
+	} EXPLAIN;
+
 	// help node */
 	struct {
 	    char *relname;
@@ -151,6 +176,13 @@ typedef struct node {
 	    struct node *joinattr2;
 	} JOIN;
 
+	// aggregate node: func (an AggFunc) of qualified attribute attr,
+	// whose attrname is NULL for count(*) */
+	struct {
+	    int func;
+	    struct node *attr;
+	} AGGR;
+
 	// qualified attribute node */
 	struct {
 	    char *relname;
@@ -177,6 +209,8 @@ typedef struct node {
 	    // 'i'-128 means integer
 	    // 'f'-128 means real
 	    // otherwise means length of string
+	    int  encoded;
+	    // 1 if a string attribute is dictionary encoded
 
 	   // char *type;
 	} ATTRTYPE;
@@ -212,9 +246,10 @@ typedef struct node {
 //
 
 NODE *newnode(int kind);
-NODE *query_node(char *relname, NODE *attrlist, NODE *n);
-NODE *insert_node(char *relname, NODE *attrlist);
+NODE *query_node(char *relname, NODE *attrlist, NODE *n, NODE *groupby);
+NODE *insert_node(char *relname, NODE *attrlist, NODE *rows);
 NODE *delete_node(char *relname, NODE *qual);
+NODE *update_node(char *relname, NODE *setlist, NODE *qual);
 NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
 NODE *destroy_node(char *relname);
 NODE *build_node(char *relname, char *attrname, int nbuckets);
@@ -222,9 +257,12 @@ NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
 NODE *drop_node(char *relname, char *attrname);
 NODE *load_node(char *relname, char *filename);
 NODE *print_node(char *relname);
+NODE *analyze_node(char *relname);
+NODE *explain_node(NODE *query);
 NODE *help_node(char *relname);
 NODE *select_node(NODE *selattr, int op, NODE *value);
 NODE *join_node(NODE *joinattr1, int op, NODE *joinattr2);
+NODE *aggr_node(char *func, NODE *attr);
 NODE *qualattr_node(char *relname, char *attrname);
 NODE *primattr_node(char *attrname, int nbuckets);
 NODE *attrval_node(char *attrname, NODE *value);
@@ -235,6 +273,7 @@ NODE *float_node(float rval);
 NODE *string_node(char *s);
 NODE *list_node(NODE *n);
 NODE *prepend(NODE *n, NODE *list);
+NODE *reverse_list(NODE *list);
 NODE *merge_attr_value_list(NODE *attr_list, NODE *value_list);
 NODE *alias_node(char *relname, char *alias);
 NODE *replace_alias_in_qualattr_list(NODE *alias, NODE *qualattr_list);
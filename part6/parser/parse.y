@@ -33,6 +33,8 @@ static NODE *parse_tree;                // root of parse tree
 		RW_DROP
 		RW_DESTROY
 		RW_PRINT
+		RW_ANALYZE
+		RW_EXPLAIN
 		RW_LOAD
 		RW_HELP
 		RW_QUIT
@@ -41,6 +43,8 @@ static NODE *parse_tree;                // root of parse tree
 		RW_WHERE
 		RW_INSERT
 		RW_DELETE
+		RW_UPDATE
+		RW_SET
 		RW_PRIMARY
 		RW_NUMBUCKETS
 		RW_ALL
@@ -51,6 +55,8 @@ static NODE *parse_tree;                // root of parse tree
 		RW_OR
 		RW_NOT
 		RW_VALUES	
+		RW_GROUP
+		RW_BY
 		INT_TYPE
 		REAL_TYPE
 		CHAR_TYPE	
@@ -72,6 +78,8 @@ static NODE *parse_tree;                // root of parse tree
 		T_QSTRING
 		T_SHELL_CMD
 
+%token		RW_ENCODED
+
 %type	<ival>	op
 
 %type	<sval>	opt_into_relname
@@ -82,6 +90,7 @@ static NODE *parse_tree;                // root of parse tree
 		query
 		insert
 		delete
+		update
 		create
 		destroy
 		build
@@ -91,14 +100,22 @@ static NODE *parse_tree;                // root of parse tree
 		drop
 		load
 		print
+		analyze
+		explain
 		help
 		quit
 		opt_primary_attr
 		opt_where
 		qual
+		predicate
+		predicate_list
 		selection
 		join
 		non_mt_qualattr_list
+		selattr
+		aggregate
+		opt_groupby
+		groupby_list
 		qualattr
 /*
 		non_mt_attrval_list
@@ -110,6 +127,9 @@ static NODE *parse_tree;                // root of parse tree
 		attrib
 		attrib_list
 		value_list
+		row_list
+		assignment_list
+		assignment
 		val
 		table_list
 		table
@@ -145,6 +165,7 @@ command
 	: query
 	| insert
 	| delete
+	| update
 	| create
 	| destroy
 	| build
@@ -154,6 +175,8 @@ command
 	| drop
 	| load
 	| print
+	| analyze
+	| explain
 	| help
 	| quit
 	| nothing
@@ -163,26 +186,52 @@ command
 	;
 
 query
-	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where
+	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where opt_groupby
 /*	RW_SELECT opt_into_relname '(' non_mt_qualattr_list ')' opt_where */
 	{
-		NODE *where;
+		NODE *where, *groupby;
 		NODE *qualattr_list = replace_alias_in_qualattr_list($5, $2);
 		if (qualattr_list == NULL) { // something wrong in qualattr_list
 		  $$ = NULL;
 		}
 		else {
 		  where = replace_alias_in_condition($5, $6);
+		  groupby = replace_alias_in_qualattr_list($5, $7);
 		  if ((where == NULL) && ($6 != NULL)) {
 		     $$ = NULL; //something wrong in where condition
 		  }
+		  else if ((groupby == NULL) && ($7 != NULL)) {
+		     $$ = NULL; //something wrong in group by
+		  }
 		  else {
-		    $$ = query_node($3, qualattr_list, where);
+		    $$ = query_node($3, qualattr_list, where, groupby);
 		  }
 		}
 	}
 	;
 
+opt_groupby
+	: RW_GROUP RW_BY groupby_list
+	{
+		$$ = $3;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+groupby_list
+	: qualattr ',' groupby_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| qualattr
+	{
+		$$ = list_node($1);
+	}
+	;
+
 table_list
 	: '(' table_list ')'
 	{
@@ -208,11 +257,28 @@ table
 	}
 
 insert
-	: RW_INSERT RW_INTO string '(' attrib_list ')' RW_VALUES '(' value_list ')' 
+	: RW_INSERT RW_INTO string '(' attrib_list ')' RW_VALUES row_list
 	{
-		NODE* tmp = merge_attr_value_list($5, $9);
-		if (tmp == NULL) $$=NULL;
-		else $$ = insert_node($3, tmp);
+		// check every row against the attributes
+		NODE *rows = reverse_list($8), *row;
+		for (row = rows; row != NULL; row = row->u.LIST.next)
+		  if (merge_attr_value_list($5, row->u.LIST.self) == NULL)
+		    break;
+		if (row != NULL) $$=NULL;
+		else $$ = insert_node($3, $5, rows);
+	}
+	;
+
+/* left recursive, so that the parser stack does not grow with the
+   number of rows; the rows come out last first */
+row_list
+	: row_list ',' '(' value_list ')'
+	{
+		$$ = prepend($4, $1);
+	}
+	| '(' value_list ')'
+	{
+		$$ = list_node($2);
 	}
 	;
 
@@ -255,6 +321,31 @@ delete
 	}
 	;
 
+update
+	: RW_UPDATE string RW_SET assignment_list opt_where
+	{
+		$$ = update_node($2, $4, $5);
+	}
+	;
+
+assignment_list
+	: assignment ',' assignment_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| assignment
+	{
+		$$ = list_node($1);
+	}
+	;
+
+assignment
+	: string T_EQ value
+	{
+		$$ = attrval_node($1, $3);
+	}
+	;
+
 create
 	: RW_CREATE RW_TABLE string '(' non_mt_attrtype_list ')' opt_primary_attr
 	{
@@ -309,6 +400,20 @@ print
 	}
 	;
 
+analyze
+	: RW_ANALYZE string
+	{
+		$$ = analyze_node($2);
+	}
+	;
+
+explain
+	: RW_EXPLAIN query
+	{
+		$$ = $2 ? explain_node($2) : NULL;
+	}
+	;
+
 help
 	: RW_HELP opt_relname
 	{
@@ -368,6 +473,25 @@ opt_where
 	;
 
 qual
+	: predicate
+	| predicate RW_AND predicate_list
+	{
+		$$ = prepend($1, $3);
+	}
+	;
+
+predicate_list
+	: predicate RW_AND predicate_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| predicate
+	{
+		$$ = list_node($1);
+	}
+	;
+
+predicate
 	: selection
 	| join
 	;
@@ -391,16 +515,34 @@ non_mt_qualattr_list
 	{
 		$$ = $2;
 	}
-	| qualattr ',' non_mt_qualattr_list
+	| selattr ',' non_mt_qualattr_list
 	{
 		$$ = prepend($1, $3);
 	}
-	| qualattr
+	| selattr
 	{
 		$$ = list_node($1);
 	}
 	;
 
+selattr
+	: qualattr
+	| aggregate
+	;
+
+aggregate
+	: string '(' qualattr ')'
+	{
+		if (($$ = aggr_node($1, $3)) == NULL)
+		  YYERROR;
+	}
+	| string '(' '*' ')'
+	{
+		if (($$ = aggr_node($1, qualattr_node(NULL, NULL))) == NULL)
+		  YYERROR;
+	}
+	;
+
 qualattr
 	: string '.' string
 	{
@@ -454,6 +596,11 @@ attrtype
 	{
 	 	$$ = attrtype_node($1, $4->u.VALUE.u.ival);
 	}
+	| string CHAR_TYPE '(' value ')' RW_ENCODED
+	{
+	 	$$ = attrtype_node($1, $4->u.VALUE.u.ival);
+		$$->u.ATTRTYPE.encoded = 1;
+	}
 	| string CHAR_TYPE
 	{
 		$$ = attrtype_node($1, 2);
@@ -60,40 +60,47 @@ extern int yydebug;
     RW_DROP = 261,                 /* RW_DROP  */
     RW_DESTROY = 262,              /* RW_DESTROY  */
     RW_PRINT = 263,                /* RW_PRINT  */
-    RW_LOAD = 264,                 /* RW_LOAD  */
-    RW_HELP = 265,                 /* RW_HELP  */
-    RW_QUIT = 266,                 /* RW_QUIT  */
-    RW_SELECT = 267,               /* RW_SELECT  */
-    RW_INTO = 268,                 /* RW_INTO  */
-    RW_WHERE = 269,                /* RW_WHERE  */
-    RW_INSERT = 270,               /* RW_INSERT  */
-    RW_DELETE = 271,               /* RW_DELETE  */
-    RW_PRIMARY = 272,              /* RW_PRIMARY  */
-    RW_NUMBUCKETS = 273,           /* RW_NUMBUCKETS  */
-    RW_ALL = 274,                  /* RW_ALL  */
-    RW_FROM = 275,                 /* RW_FROM  */
-    RW_AS = 276,                   /* RW_AS  */
-    RW_TABLE = 277,                /* RW_TABLE  */
-    RW_AND = 278,                  /* RW_AND  */
-    RW_OR = 279,                   /* RW_OR  */
-    RW_NOT = 280,                  /* RW_NOT  */
-    RW_VALUES = 281,               /* RW_VALUES  */
-    INT_TYPE = 282,                /* INT_TYPE  */
-    REAL_TYPE = 283,               /* REAL_TYPE  */
-    CHAR_TYPE = 284,               /* CHAR_TYPE  */
-    T_EQ = 285,                    /* T_EQ  */
-    T_LT = 286,                    /* T_LT  */
-    T_LE = 287,                    /* T_LE  */
-    T_GT = 288,                    /* T_GT  */
-    T_GE = 289,                    /* T_GE  */
-    T_NE = 290,                    /* T_NE  */
-    T_EOF = 291,                   /* T_EOF  */
-    NOTOKEN = 292,                 /* NOTOKEN  */
-    T_INT = 293,                   /* T_INT  */
-    T_REAL = 294,                  /* T_REAL  */
-    T_STRING = 295,                /* T_STRING  */
-    T_QSTRING = 296,               /* T_QSTRING  */
-    T_SHELL_CMD = 297              /* T_SHELL_CMD  */
+    RW_ANALYZE = 264,              /* RW_ANALYZE  */
+    RW_EXPLAIN = 265,              /* RW_EXPLAIN  */
+    RW_LOAD = 266,                 /* RW_LOAD  */
+    RW_HELP = 267,                 /* RW_HELP  */
+    RW_QUIT = 268,                 /* RW_QUIT  */
+    RW_SELECT = 269,               /* RW_SELECT  */
+    RW_INTO = 270,                 /* RW_INTO  */
+    RW_WHERE = 271,                /* RW_WHERE  */
+    RW_INSERT = 272,               /* RW_INSERT  */
+    RW_DELETE = 273,               /* RW_DELETE  */
+    RW_UPDATE = 274,               /* RW_UPDATE  */
+    RW_SET = 275,                  /* RW_SET  */
+    RW_PRIMARY = 276,              /* RW_PRIMARY  */
+    RW_NUMBUCKETS = 277,           /* RW_NUMBUCKETS  */
+    RW_ALL = 278,                  /* RW_ALL  */
+    RW_FROM = 279,                 /* RW_FROM  */
+    RW_AS = 280,                   /* RW_AS  */
+    RW_TABLE = 281,                /* RW_TABLE  */
+    RW_AND = 282,                  /* RW_AND  */
+    RW_OR = 283,                   /* RW_OR  */
+    RW_NOT = 284,                  /* RW_NOT  */
+    RW_VALUES = 285,               /* RW_VALUES  */
+    RW_GROUP = 286,                /* RW_GROUP  */
+    RW_BY = 287,                   /* RW_BY  */
+    INT_TYPE = 288,                /* INT_TYPE  */
+    REAL_TYPE = 289,               /* REAL_TYPE  */
+    CHAR_TYPE = 290,               /* CHAR_TYPE  */
+    T_EQ = 291,                    /* T_EQ  */
+    T_LT = 292,                    /* T_LT  */
+    T_LE = 293,                    /* T_LE  */
+    T_GT = 294,                    /* T_GT  */
+    T_GE = 295,                    /* T_GE  */
+    T_NE = 296,                    /* T_NE  */
+    T_EOF = 297,                   /* T_EOF  */
+    NOTOKEN = 298,                 /* NOTOKEN  */
+    T_INT = 299,                   /* T_INT  */
+    T_REAL = 300,                  /* T_REAL  */
+    T_STRING = 301,                /* T_STRING  */
+    T_QSTRING = 302,               /* T_QSTRING  */
+    T_SHELL_CMD = 303,             /* T_SHELL_CMD  */
+    RW_ENCODED = 304               /* RW_ENCODED  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -108,40 +115,47 @@ extern int yydebug;
 #define RW_DROP 261
 #define RW_DESTROY 262
 #define RW_PRINT 263
-#define RW_LOAD 264
-#define RW_HELP 265
-#define RW_QUIT 266
-#define RW_SELECT 267
-#define RW_INTO 268
-#define RW_WHERE 269
-#define RW_INSERT 270
-#define RW_DELETE 271
-#define RW_PRIMARY 272
-#define RW_NUMBUCKETS 273
-#define RW_ALL 274
-#define RW_FROM 275
-#define RW_AS 276
-#define RW_TABLE 277
-#define RW_AND 278
-#define RW_OR 279
-#define RW_NOT 280
-#define RW_VALUES 281
-#define INT_TYPE 282
-#define REAL_TYPE 283
-#define CHAR_TYPE 284
-#define T_EQ 285
-#define T_LT 286
-#define T_LE 287
-#define T_GT 288
-#define T_GE 289
-#define T_NE 290
-#define T_EOF 291
-#define NOTOKEN 292
-#define T_INT 293
-#define T_REAL 294
-#define T_STRING 295
-#define T_QSTRING 296
-#define T_SHELL_CMD 297
+#define RW_ANALYZE 264
+#define RW_EXPLAIN 265
+#define RW_LOAD 266
+#define RW_HELP 267
+#define RW_QUIT 268
+#define RW_SELECT 269
+#define RW_INTO 270
+#define RW_WHERE 271
+#define RW_INSERT 272
+#define RW_DELETE 273
+#define RW_UPDATE 274
+#define RW_SET 275
+#define RW_PRIMARY 276
+#define RW_NUMBUCKETS 277
+#define RW_ALL 278
+#define RW_FROM 279
+#define RW_AS 280
+#define RW_TABLE 281
+#define RW_AND 282
+#define RW_OR 283
+#define RW_NOT 284
+#define RW_VALUES 285
+#define RW_GROUP 286
+#define RW_BY 287
+#define INT_TYPE 288
+#define REAL_TYPE 289
+#define CHAR_TYPE 290
+#define T_EQ 291
+#define T_LT 292
+#define T_LE 293
+#define T_GT 294
+#define T_GE 295
+#define T_NE 296
+#define T_EOF 297
+#define NOTOKEN 298
+#define T_INT 299
+#define T_REAL 300
+#define T_STRING 301
+#define T_QSTRING 302
+#define T_SHELL_CMD 303
+#define RW_ENCODED 304
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -154,7 +168,7 @@ union YYSTYPE
   char *sval;
   NODE *n;
 
-#line 158 "y.tab.h"
+#line 172 "y.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -7,6 +7,17 @@
 // define if debug output wanted
 //#define DEBUGPART
 
+// directory the partition files are written to (SPILLDIR=dir option);
+// if empty, the database directory
+extern string SpillDir;
+
+// name of temporary file fileName.suffix in SpillDir
+string spillName(const string & fileName, const string & suffix);
+
+const int PARTFANOUT = 64;              // most partitions written by
+					// one pass over the records
+
+class PartWriter;
 
 class Partition {
  public:
@@ -17,13 +28,31 @@ class Partition {
 				 const int P),  
 	                               // hash function to use in partitioning
 	    string* &partName,           // names of partitioned heap files
-	    Status &status);            // create partitions of file
+	    Status &status,             // create partitions of file
+	    const Status (*resident)(const Record & rec) = NULL,
+	                  // if given, gets the records of partition 0
+	    const bool (*keep)(const Record & rec) = NULL);
+	                  // if given, drops the records it returns false for
+  Partition(const string & fileName,    // (base) name of heap file
+	    const int P,                      // number of partitions
+	    const int (*hashfcn)(const Record & rec,
+				 const int P),
+	    string* &partName,           // names of partitioned heap files
+	    Status &status);            // create empty partitions, for add()
   ~Partition();                         // destroy partitions
 
+  Status add(const int p, const Record & rec);  // to partition p
+  Status finish();                      // after the last add()
+
  private:
+  Status create(const string & fileName, string* &partName);
+  Status splitGroups();
 
   int P;                                // number of partitions
   string *partName;                      // partition names
+  const int (*hashfcn)(const Record & rec, const int P);
+  vector<string> groupName;             // of the first pass, if P > PARTFANOUT
+  PartWriter *writer;                   // of add()
 };
 
 #endif
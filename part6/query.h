@@ -3,7 +3,23 @@
 
 #include "heapfile.h"
 
-enum JoinType {NLJoin, SMJoin, HashJoin};
+// define if debug output wanted
+//#define DEBUGJOIN
+
+enum JoinType {NLJoin, SMJoin, HashJoin, CostBased};
+
+// aggregate functions
+enum AggFunc { CountAgg, SumAgg, AvgAgg, MinAgg, MaxAgg };
+
+// the join method forced with the NL, SM or HJ option, or CostBased
+// (the default) to have the cost model (cost.h) pick one per join
+extern JoinType JoinMethod;
+
+// set by `explain': the planners print the estimates and costs their
+// choices are based on, and the plan is not run
+extern bool Explain;
+
+class Iterator;
 
 //
 // Prototypes for query layer functions
@@ -24,9 +40,97 @@ const Status QU_Join(const string & result,
 		     const Operator op, 
 		     const attrInfo *attr2);
 
+// Plans of selections and joins (see exec.h), projecting on the
+// attributes projNames into tuples of the attributes outAttrs (or of
+// the projected ones, decoded, if outAttrs is NULL).  The caller runs
+// the plan and deletes it.
+
+const Status QU_SelectPlan(const int projCnt, 
+			   const attrInfo projNames[],
+			   const attrInfo outAttrs[],
+			   const attrInfo *attr, 
+			   const Operator op, 
+			   const char *attrValue,
+			   Iterator *& plan);
+
+const Status QU_JoinPlan(const int projCnt, 
+			 const attrInfo projNames[],
+			 const attrInfo outAttrs[],
+			 const attrInfo *attr1, 
+			 const Operator op, 
+			 const attrInfo *attr2,
+			 Iterator *& plan);
+
+// One predicate of a conjunctive qualification: the selection `attr1
+// op attr1.attrValue' if attr1.attrValue is given, else the join
+// `attr1 op attr2'.
+typedef struct {
+  attrInfo attr1;
+  Operator op;
+  attrInfo attr2;
+} Predicate;
+
+// Plan of a query over any number of relations whose qualification is
+// the conjunction of predCnt predicates: the relations are joined in
+// the order the cost model finds cheapest (see multijoin.C).
+const Status QU_MultiJoinPlan(const int projCnt,
+			      const attrInfo projNames[],
+			      const attrInfo outAttrs[],
+			      const int predCnt,
+			      const Predicate preds[],
+			      Iterator *& plan);
+
+// An aggregate of a query: func of attribute attr, or count(*) if
+// attr.attrName is empty (attr.relName then names a relation of the
+// query).
+typedef struct {
+  AggFunc func;
+  attrInfo attr;
+} Aggregate;
+
+// Plan of a query with aggregates (see agg.C).  The tuples of the
+// relations for which the predCnt predicates hold are grouped on the
+// groupCnt attributes groupNames (all are one group if there are
+// none), and the aggregates aggs are computed per group.  Attribute i
+// of the result is group attribute proj[i] if proj[i] < groupCnt, and
+// aggregate proj[i] - groupCnt otherwise, with the name and type of
+// outAttrs[i] (or named after the aggregate, if outAttrs is NULL).
+const Status QU_AggregatePlan(const int groupCnt,
+			      const attrInfo groupNames[],
+			      const int aggCnt,
+			      const Aggregate aggs[],
+			      const int projCnt,
+			      const int proj[],
+			      const attrInfo outAttrs[],
+			      const int predCnt,
+			      const Predicate preds[],
+			      Iterator *& plan);
+
+// the name of an aggregate function, as in a query
+const char *aggName(const AggFunc func);
+
+// the value of the selection `attr op attrValue' as attr stores it,
+// and the operator to compare stored values with
+const Status QU_StoredValue(const AttrDesc & attr,
+			    const Operator op,
+			    const char *attrValue,
+			    char *value,
+			    Operator & storedOp);
+
+// runs plan, inserting its tuples into relation result
+const Status QU_Run(Iterator *plan, const string & result);
+
+// inserts rowCnt tuples, attrList holding attrCnt attributes (names
+// and values) for each in turn.  Consecutive inserts into a relation
+// keep it open until QU_EndInsert().
 const Status QU_Insert(const string & relation, 
 		       const int attrCnt, 
-		       const attrInfo attrList[]);
+		       const attrInfo attrList[],
+		       const int rowCnt);
+
+// closes the relation kept open by inserts, if any; due before any
+// other statement
+void QU_EndInsert();
 
 const Status QU_Delete(const string & relation, 
 		       const string & attrName, 
@@ -34,4 +138,15 @@ const Status QU_Delete(const string & relation,
 		       const Datatype type, 
 		       const char *attrValue);
 
+// sets attributes attrList (names and values as for QU_Insert) of the
+// tuples satisfying `attrName op attrValue', or of all tuples if
+// attrName is empty, in place
+const Status QU_Update(const string & relation,
+		       const int attrCnt,
+		       const attrInfo attrList[],
+		       const string & attrName,
+		       const Operator op,
+		       const Datatype type,
+		       const char *attrValue);
+
 #endif
@@ -2,21 +2,16 @@
 #define SORT_H
 
 #include "heapfile.h"
+#include "sortKey.h"
 
 // define if debug output wanted
 //#define DEBUGSORT
 
+// threads a sort uses (THREADS=n option)
+extern int SortThreads;
 
-// SORTREC is an in-memory sort record that qsort(3) sorts.
-// The sort attribute as well as the associated RID are
-// stored in the record. The RID is used for fetching the
-// full record when it is needed.
-
-typedef struct {
-  RID rid;                              // record id of current record
-  char* field;                          // pointer to field
-  int length;                           // length of field
-} SORTREC;
+const int RUNFRAMES = 3;                // frames an open run pins: its
+					// header, directory and current page
 
 
 class SortedFile {
@@ -24,7 +19,9 @@ class SortedFile {
   SortedFile(const string & fileName, 
 	     int offset,// sort source file on the given
 	     int length, Datatype type, // attribute
-	     int maxItems, Status& status);
+	     int maxItems, Status& status,
+	     const bool (*keep)(const Record & rec) = NULL);
+	                  // if given, sorts only the records it returns true for
 
   Status next(Record & rec);            // fetch next record in sort order
   Status setMark();                     // record a position in sort sequence
@@ -33,7 +30,18 @@ class SortedFile {
 
  private:
   Status sortFile();                    // split source file into sub-runs
-  Status generateRun(int numItems);     // generate one sub-run of file
+  Status fill(int from, int to, int & n, bool & more);
+                                        // read records into buffer[from..to)
+  Status selectRuns();                  // runs by replacement selection
+  Status sortRuns();                    // runs of buffers sorted on threads
+  Status newRun();                      // create the next sub-run
+  Status writeItem(const SORTREC & item); // append item to its run
+  Status writeRun(int from, int n);     // buffer[from..from+n) as a run
+  bool itemLess(int i, int j) const;    // orders the sort buffer heap
+  void siftDown(int i);                 // restores heap below buffer[i]
+  Status mergePasses();                 // merge runs down to fanIn of them
+  Status mergeRuns(int n);              // merge the first n runs into one
+  Status mergeRanges();                 // merge all runs into one, on threads
   Status startScans();                  // start a scan on each sorted run
 
   typedef struct {
@@ -44,20 +52,43 @@ class SortedFile {
     Record rec;
     RID rid;                            // RID of current record of run
     RID mark;
+    int markStart;                      // TRUE if marked before the
+					// first record was fetched
   } RUN;
 
   vector<RUN> runs;                   // holds info about each sub-run
 
-  HeapFile* hfile;                   // source file to sort
+  // Tournament (loser) tree over the runs being merged. tree[0] is
+  // the run with the smallest current record, and each internal node
+  // tree[1..k-1] holds the run that lost the match played there; run
+  // i is leaf k+i. Replacing the winner's record replays only the
+  // matches on its path to the root, log k comparisons.
+
+  Status fetch(RUN & run);              // read the next record of a run
+  bool runLess(int a, int b) const;     // compares current records
+  int playTree(int node);               // builds subtree, returns winner
+  void replay(int leaf);                // after leaf's record changed
+
+  vector<RUN*> merging;                 // the runs in the tree
+  vector<int> tree;
+  bool treeBuilt;                       // false after gotoMark()
+  int fanIn;                            // most runs merged at once
+  int runCnt;                           // runs created, for their names
+
   HeapFileScan* hfs;                   // source file to sort
   string fileName;                      // name of source file to sort
+  int sortId;                           // tells apart the runs of
+					// concurrent sorts of one file
   Datatype type;                        // type of sort attribute
   int offset;                           // offset of sort attribute
   int length;                           // length of sort attribute
 
   SORTREC* buffer;                      // in-memory sort buffer
+  char* arena;                          // the records in buffer
   int maxItems;                         // max. # of items/tuples in buffer
+  const bool (*keep)(const Record & rec); // filter on the source records
   int numItems;                         // current # of items in buffer
+  int slotLen;                          // length of a record's arena slot
 };
 
 #endif
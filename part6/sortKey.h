@@ -0,0 +1,71 @@
+#ifndef SORTKEY_H
+#define SORTKEY_H
+
+#include "heapfile.h"
+
+// SORTREC is an entry of the in-memory sort buffer. The whole
+// source record is copied into the buffer's arena once, and runs
+// are written from there. key is the sort attribute normalized by
+// sortKey(), so that most comparisons are of two integers. run is
+// the number of the run the record goes to.
+
+typedef struct {
+  unsigned long long key;               // normalized sort attribute
+  char* data;                           // record in the arena
+  int length;                           // length of record
+  int run;                              // run the record belongs to
+} SORTREC;
+
+
+// Normalized key of the attribute at attrPtr: an unsigned integer
+// that orders like the attribute. INTEGERs have their sign bit
+// flipped, FLOATs are turned into integers in IEEE order (negative
+// ones inverted, -0 made 0), and a STRING keeps its first 8 bytes,
+// most significant first.
+
+unsigned long long sortKey(const char* attrPtr, const Datatype type,
+			   const int len);
+
+// true if sortKey() holds all of an attribute of this type and
+// length, so that equal keys mean equal attributes
+
+inline bool exactKey(const Datatype type, const int len)
+{
+  return type != STRING || len <= (int)sizeof(unsigned long long);
+}
+
+// Sort items on key with an LSD radix sort. If the keys are not
+// exact, large groups of items with equal keys are then radix sorted
+// on the next 8 bytes of the attribute, and small ones on the whole
+// attribute, which is at offset in each record.
+
+void radixSort(SORTREC* items, const int n, const int offset,
+	       const int len, const Datatype type);
+
+// below this many items per thread, a single thread does the work
+// of parallelSort() or of a parallel merge
+
+const int PARALLELMIN = 16 * 1024;
+
+// keys sampled per thread to pick the splitters
+
+const int SAMPLEPERTHREAD = 64;
+
+// Splitters for threads key ranges of about the same size: evenly
+// spaced keys of sample, which is sorted. An item goes to range
+// upper_bound(splitter, key), the number of splitters not greater
+// than its key, so that equal keys (which may still need their
+// attributes compared) always end up in the same range.
+
+void pickSplitters(vector<unsigned long long> & sample, const int threads,
+		   vector<unsigned long long> & splitter);
+
+// Sort like radixSort(), on up to threads threads. The items are split
+// into one key range per thread, by splitters taken from a sample of
+// the keys, and each range is sorted on its own thread. Small inputs
+// are sorted on the calling thread alone.
+
+void parallelSort(SORTREC* items, const int n, const int offset,
+		  const int len, const Datatype type, int threads);
+
+#endif
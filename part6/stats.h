@@ -0,0 +1,121 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <map>
+#include "catalog.h"
+
+
+// define if debug output wanted
+//#define DEBUGSTATS
+
+
+// Statistics of relations, for estimating the sizes of query results.
+// `analyze <relation>' (UT_Analyze) computes them and keeps them in the
+// statistics catalog, a heap file named statcat that is made the first
+// time a relation is analyzed.  The file holds a RelStats record for
+// each analyzed relation and an AttrStats record for each of its
+// attributes; the two are told apart by their length.  The whole file
+// is read into a cache the first time statistics are asked for.
+//
+// Statistics describe the stored values of an attribute (so the codes
+// of an encoded one), as sortKey() normalizes them, and are not kept
+// up to date as the relation changes: they are as of the last analyze.
+
+#define STATCATNAME  "statcat"          // name of statistics catalog
+
+const int HLLBITS = 8;                  // HyperLogLog register index bits
+const int HLLREGS = 1 << HLLBITS;       // so 256 registers, ~6.5% error
+const int HISTBUCKETS = 16;             // buckets of the histograms
+const int SAMPLEPAGES = 100;            // relations of more pages are
+					// analyzed on that many of them
+const int HISTSAMPLE = 10000;           // values a histogram is made from
+
+// default selectivities, for attributes without statistics
+const double DEFAULTEQSEL = 0.1;
+const double DEFAULTRANGESEL = 1.0 / 3;
+
+
+// HyperLogLog sketch of the distinct values of an attribute: the
+// values are hashed, a register is picked by the first HLLBITS bits of
+// the hash and keeps the longest run of leading zeros seen in the rest.
+
+struct HyperLogLog {
+  unsigned char reg[HLLREGS];
+
+  void clear();
+  void add(const unsigned long long hash);
+  double estimate() const;              // number of distinct values
+
+  // 64 bit hash of the attribute value at p
+  static unsigned long long hash(const char *p, const AttrDesc & attr);
+};
+
+
+typedef struct {
+  char relName[MAXNAME];                // relation name
+  int pageCnt;                          // data pages
+  int tupleCnt;                         // tuples
+  int samplePages;                      // pages analyze read
+} RelStats;
+
+typedef struct {
+  char relName[MAXNAME];                // relation name
+  char attrName[MAXNAME];               // attribute name
+  double distinct;                      // estimated distinct values
+  unsigned long long minKey, maxKey;    // least and greatest sortKey()
+  unsigned long long bounds[HISTBUCKETS + 1];
+					// equi-depth histogram: about a
+					// HISTBUCKETSth of the values
+					// lie between two bounds
+  HyperLogLog sketch;                   // of the values read
+} AttrStats;
+
+
+class Statistics {
+ public:
+  // the statistics of a relation, NULL if it has not been analyzed
+  static const Status get(const string & relation,
+			  const Statistics *& stats);
+
+  // replace the statistics of a relation
+  static const Status put(const RelStats & rel,
+			  const vector<AttrStats> & attrs);
+
+  // forget the statistics of a relation
+  static const Status drop(const string & relation);
+
+  // the number of data pages and tuples of a relation, as of the last
+  // analyze, or else from its file
+  static const Status size(const string & relation, int & pageCnt,
+			   int & tupleCnt);
+
+  // estimated fraction of the tuples of attr's relation for which
+  // `attr op value' holds; value is a stored value of attr
+  static double selectivity(const AttrDesc & attr, const Operator op,
+			    const char *value);
+
+  // estimated fraction of the pairs of tuples of the relations of
+  // attr1 and attr2 for which `attr1 op attr2' holds
+  static double joinSelectivity(const AttrDesc & attr1, const Operator op,
+				const AttrDesc & attr2);
+
+  const RelStats & relation() const { return rel; }
+
+  // statistics of attribute attrName, NULL if there are none
+  const AttrStats *attribute(const string & attrName) const;
+
+ private:
+  Statistics() {}
+
+  static const Status load();           // read the catalog
+  static const Status write();          // rewrite it
+
+  RelStats rel;
+  vector<AttrStats> attrs;
+
+  static map<string, Statistics *> cache;
+  static bool loaded;
+};
+
+
+#endif
@@ -27,6 +27,11 @@ const Status UT_Load(const string & relation,
 
 const Status UT_Print(string relation);
 
+const Status UT_Analyze(const string & relation);
+
+class Iterator;
+const Status UT_Print(Iterator *plan, const string & name);
+
 void   UT_Quit(void);
 
 #endif